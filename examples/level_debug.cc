@@ -5,6 +5,8 @@
 
 #include <simple_logger/simple_logger.hpp>
 
+#include <iostream>
+
 using namespace simple_logger;
 
 int main() {
@@ -0,0 +1,20 @@
+// This file is part of simple_logger.
+// Copyright (c) 2023, Timothy Liu. All rights reserved.
+// License    : MIT License
+// Project URL: https://github.com/Timothy-Liuxf/simple_logger
+
+#include <simple_logger/simple_logger.hpp>
+
+using namespace simple_logger;
+
+struct LogOnExit {
+  ~LogOnExit() { logger.Info("Info message from a static destructor."); }
+};
+
+static LogOnExit log_on_exit;
+
+int main() {
+  SetThreadName("main-thread-with-a-name-longer-than-the-limit");
+  logger.Info("Info message from main.");
+  return 0;
+}
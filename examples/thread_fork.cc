@@ -0,0 +1,26 @@
+// This file is part of simple_logger.
+// Copyright (c) 2023, Timothy Liu. All rights reserved.
+// License    : MIT License
+// Project URL: https://github.com/Timothy-Liuxf/simple_logger
+
+#include <simple_logger/simple_logger.hpp>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace simple_logger;
+
+int main() {
+  SetThreadName("main");
+  logger.Info("Info message from the parent before fork.");
+
+  pid_t pid = fork();
+  if (pid == 0) {
+    logger.Info("Info message from the child.");
+    return 0;
+  }
+
+  waitpid(pid, nullptr, 0);
+  logger.Info("Info message from the parent after fork.");
+  return 0;
+}
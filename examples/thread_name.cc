@@ -0,0 +1,37 @@
+// This file is part of simple_logger.
+// Copyright (c) 2023, Timothy Liu. All rights reserved.
+// License    : MIT License
+// Project URL: https://github.com/Timothy-Liuxf/simple_logger
+
+#include <simple_logger/simple_logger.hpp>
+
+#include <future>
+#include <thread>
+
+using namespace simple_logger;
+
+int main() {
+  SetThreadName("main");
+  logger.Info("Info message from the main thread.");
+
+  // Keep the worker alive until the unnamed thread has logged, so that the OS
+  // cannot hand the worker's thread ID over to the unnamed thread.
+  std::promise<void> logged;
+  std::promise<void> release;
+  std::thread        worker([&] {
+    SetThreadName("worker");
+    logger.Warn("Warn message from a named thread.");
+    logged.set_value();
+    release.get_future().wait();
+  });
+  logged.get_future().wait();
+
+  std::thread unnamed([] {
+    logger.Error("Error message from an unnamed thread.");
+  });
+  unnamed.join();
+
+  release.set_value();
+  worker.join();
+  return 0;
+}
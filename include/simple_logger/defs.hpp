@@ -18,8 +18,13 @@
 #error "Unsupported platform"
 #endif  // OS
 
+#if defined(SIMPLE_LOGGER_COMPILED_LIB)
+#define SIMPLE_LOGGER_INLINE
+#else
+#define SIMPLE_LOGGER_INLINE inline
 #ifndef FMT_HEADER_ONLY
 #define FMT_HEADER_ONLY
 #endif  // FMT_HEADER_ONLY
+#endif  // SIMPLE_LOGGER_COMPILED_LIB
 
 #endif  // SIMPLE_LOGGER_DEFS_HPP
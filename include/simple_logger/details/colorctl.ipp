@@ -23,28 +23,6 @@ static constexpr inline ColorCtlType kBeginBlue  = FOREGROUND_BLUE;
 static constexpr inline ColorCtlType kBeginYellow =
     FOREGROUND_RED | FOREGROUND_GREEN;
 
-inline ColorCtlType GetOutputEndColorToken() noexcept {
-  win32::CONSOLE_SCREEN_BUFFER_INFO csbi;
-  win32::GetConsoleScreenBufferInfo(win32::GetStdHandle(STD_OUTPUT_HANDLE),
-                                    &csbi);
-  return csbi.wAttributes;
-}
-
-inline ColorCtlType GetErrorEndColorToken() noexcept {
-  win32::CONSOLE_SCREEN_BUFFER_INFO csbi;
-  win32::GetConsoleScreenBufferInfo(win32::GetStdHandle(STD_ERROR_HANDLE),
-                                    &csbi);
-  return csbi.wAttributes;
-}
-
-inline void SetOutputColor(ColorCtlType token) {
-  win32::SetConsoleTextAttribute(win32::GetStdHandle(STD_OUTPUT_HANDLE), token);
-}
-
-inline void SetErrorColor(ColorCtlType token) {
-  win32::SetConsoleTextAttribute(win32::GetStdHandle(STD_ERROR_HANDLE), token);
-}
-
 #elif defined(SIMPLE_LOGGER_UNIX)
 
 using namespace std::literals::string_view_literals;
@@ -55,10 +33,4 @@ static constexpr inline ColorCtlType kBeginGreen  = "\033[32m"sv;
 static constexpr inline ColorCtlType kBeginBlue   = "\033[34m"sv;
 static constexpr inline ColorCtlType kBeginYellow = "\033[33m"sv;
 
-inline ColorCtlType GetOutputEndColorToken() noexcept { return "\033[0m"sv; }
-inline ColorCtlType GetErrorEndColorToken() noexcept { return "\033[0m"sv; }
-
-inline void         SetOutputColor(ColorCtlType token) { std::cout << token; }
-inline void         SetErrorColor(ColorCtlType token) { std::cerr << token; }
-
 #endif  // OS
@@ -0,0 +1,16 @@
+// This file is part of simple_logger.
+// Copyright (c) 2023, Timothy Liu. All rights reserved.
+// License    : MIT License
+// Project URL: https://github.com/Timothy-Liuxf/simple_logger
+
+#ifndef SIMPLE_LOGGER_HPP_
+#error                                                                         \
+    "This file should not be included directly. Include simple_logger.hpp instead."
+#endif  // SIMPLE_LOGGER_HPP_
+
+// Must match the C library's declaration, which user code may also include.
+#if defined(__GLIBC__)
+extern "C" long syscall(long, ...) __THROW;
+#else   // musl, bionic
+extern "C" long syscall(long, ...);
+#endif  // __GLIBC__
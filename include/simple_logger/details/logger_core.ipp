@@ -0,0 +1,248 @@
+// This file is part of simple_logger.
+// Copyright (c) 2023, Timothy Liu. All rights reserved.
+// License    : MIT License
+// Project URL: https://github.com/Timothy-Liuxf/simple_logger
+
+#ifndef SIMPLE_LOGGER_HPP_
+#error                                                                         \
+    "This file should not be included directly. Include simple_logger.hpp instead."
+#endif  // SIMPLE_LOGGER_HPP_
+
+#if defined(__linux__)
+
+namespace sys {
+
+#include "linux.ipp"
+
+}  // namespace sys
+
+#endif  // __linux__
+
+#if defined(SIMPLE_LOGGER_WINDOWS)
+
+SIMPLE_LOGGER_INLINE ColorCtlType GetOutputEndColorToken() noexcept {
+  win32::CONSOLE_SCREEN_BUFFER_INFO csbi;
+  win32::GetConsoleScreenBufferInfo(win32::GetStdHandle(STD_OUTPUT_HANDLE),
+                                    &csbi);
+  return csbi.wAttributes;
+}
+
+SIMPLE_LOGGER_INLINE ColorCtlType GetErrorEndColorToken() noexcept {
+  win32::CONSOLE_SCREEN_BUFFER_INFO csbi;
+  win32::GetConsoleScreenBufferInfo(win32::GetStdHandle(STD_ERROR_HANDLE),
+                                    &csbi);
+  return csbi.wAttributes;
+}
+
+SIMPLE_LOGGER_INLINE void SetOutputColor(ColorCtlType token) {
+  win32::SetConsoleTextAttribute(win32::GetStdHandle(STD_OUTPUT_HANDLE), token);
+}
+
+SIMPLE_LOGGER_INLINE void SetErrorColor(ColorCtlType token) {
+  win32::SetConsoleTextAttribute(win32::GetStdHandle(STD_ERROR_HANDLE), token);
+}
+
+#elif defined(SIMPLE_LOGGER_UNIX)
+
+SIMPLE_LOGGER_INLINE ColorCtlType GetOutputEndColorToken() noexcept {
+  return "\033[0m"sv;
+}
+
+SIMPLE_LOGGER_INLINE ColorCtlType GetErrorEndColorToken() noexcept {
+  return "\033[0m"sv;
+}
+
+SIMPLE_LOGGER_INLINE void SetOutputColor(ColorCtlType token) {
+  std::cout << token;
+}
+
+SIMPLE_LOGGER_INLINE void SetErrorColor(ColorCtlType token) {
+  std::cerr << token;
+}
+
+#endif  // OS
+
+SIMPLE_LOGGER_INLINE std::uint64_t GetThreadId() noexcept {
+#if defined(SIMPLE_LOGGER_WINDOWS)
+  return win32::GetCurrentThreadId();
+#elif defined(__linux__)
+  return static_cast<std::uint64_t>(sys::syscall(SYS_gettid));
+#else
+  return std::hash<std::thread::id> {}(std::this_thread::get_id());
+#endif  // OS
+}
+
+static constexpr std::size_t kThreadPrefixCapacity =
+    sizeof("[18446744073709551615] [] ") - 1 + kMaxThreadNameLength;
+
+// Thread fields of the prefix, rendered once per thread. Kept trivially
+// destructible so that records logged from static destructors, which run after
+// the main thread's thread-locals are destroyed, still read valid memory.
+struct ThreadInfo {
+  bool          has_id;
+  bool          rendered;
+  unsigned      fields;
+  std::uint64_t id;
+  std::size_t   name_size;
+  char          name[kMaxThreadNameLength];
+  std::size_t   prefix_size;
+  char          prefix[kThreadPrefixCapacity];
+};
+
+SIMPLE_LOGGER_INLINE ThreadInfo& GetThreadInfo() noexcept {
+  thread_local ThreadInfo info {};
+  return info;
+}
+
+SIMPLE_LOGGER_INLINE void SetThreadName(std::string_view name) {
+  auto& info     = GetThreadInfo();
+  info.name_size = name.size() < kMaxThreadNameLength ? name.size()
+                                                      : kMaxThreadNameLength;
+  std::char_traits<char>::copy(info.name, name.data(), info.name_size);
+  info.rendered = false;
+}
+
+#if defined(SIMPLE_LOGGER_UNIX)
+// A forked child inherits the ThreadInfo of the forking thread, whose cached
+// ID belongs to the parent.
+SIMPLE_LOGGER_INLINE void ResetThreadIdInChild() noexcept {
+  auto& info    = GetThreadInfo();
+  info.has_id   = false;
+  info.rendered = false;
+}
+#endif  // SIMPLE_LOGGER_UNIX
+
+SIMPLE_LOGGER_INLINE std::string_view GetThreadPrefix(unsigned thread_fields) {
+  auto& info = GetThreadInfo();
+  if (!info.rendered || info.fields != thread_fields) {
+    if (!info.has_id) {
+#if defined(SIMPLE_LOGGER_UNIX)
+      static const int fork_handler =
+          ::pthread_atfork(nullptr, nullptr, &ResetThreadIdInChild);
+      (void)fork_handler;
+#endif  // SIMPLE_LOGGER_UNIX
+      info.id     = GetThreadId();
+      info.has_id = true;
+    }
+    auto out = info.prefix;
+    if (thread_fields & kThreadIdField) {
+      out = fmt::format_to(out, "[{}] ", info.id);
+    }
+    if ((thread_fields & kThreadNameField) && info.name_size != 0) {
+      out = fmt::format_to(out, "[{}] ",
+                           std::string_view(info.name, info.name_size));
+    }
+    info.prefix_size = static_cast<std::size_t>(out - info.prefix);
+    info.fields      = thread_fields;
+    info.rendered    = true;
+  }
+  return std::string_view(info.prefix, info.prefix_size);
+}
+
+template <bool ThreadSafe>
+class LoggerLock {
+ private:
+  static void Lock() {}
+  static void Unlock() {}
+
+  friend class LoggerCore<ThreadSafe>;
+};
+
+template <>
+class LoggerLock<true> {
+ private:
+  static inline std::mutex lock;
+
+ private:
+  static void Lock() { lock.lock(); }
+  static void Unlock() { lock.unlock(); }
+
+  friend class LoggerCore<true>;
+};
+
+SIMPLE_LOGGER_INLINE void PrintTime(std::ostream& os) {
+  os << fmt::format("{:%Y-%m-%d %H:%M:%S} ",
+                    fmt::localtime(std::chrono::system_clock::to_time_t(
+                        std::chrono::system_clock::now())));
+}
+
+template <bool ThreadSafe>
+SIMPLE_LOGGER_INLINE std::ostream& LoggerCore<ThreadSafe>::BeginRecord(
+    OutputStream stream, std::string_view level, unsigned thread_fields) {
+  // Rendered before locking: the first record of a thread makes a system call.
+  auto thread_prefix =
+      thread_fields != 0 ? GetThreadPrefix(thread_fields) : std::string_view();
+  auto functy = [&]() -> std::ostream& {
+    auto& os = stream == OutputStream::kStdout ? std::cout : std::cerr;
+    PrintTime(os);
+    os << '[' << level << "] " << thread_prefix;
+    return os;
+  };
+  return LoggerCore::HandleThreadSafe(functy);
+}
+
+template <bool ThreadSafe>
+SIMPLE_LOGGER_INLINE std::ostream& LoggerCore<ThreadSafe>::BeginRecord(
+    OutputStream stream, ColorCtlType token, std::string_view level,
+    unsigned thread_fields, ColorCtlType& end_token) {
+  auto thread_prefix =
+      thread_fields != 0 ? GetThreadPrefix(thread_fields) : std::string_view();
+  auto functy = [&]() -> std::ostream& {
+    if (stream == OutputStream::kStdout) {
+      end_token = GetOutputEndColorToken();
+      SetOutputColor(token);
+    } else {
+      end_token = GetErrorEndColorToken();
+      SetErrorColor(token);
+    }
+    auto& os = stream == OutputStream::kStdout ? std::cout : std::cerr;
+    PrintTime(os);
+    os << '[' << level << "] " << thread_prefix;
+    return os;
+  };
+  return LoggerCore::HandleThreadSafe(functy);
+}
+
+template <bool ThreadSafe>
+SIMPLE_LOGGER_INLINE void LoggerCore<ThreadSafe>::EndRecord(
+    std::ostream& os, OutputStream stream, bool colored,
+    ColorCtlType end_token) {
+  auto functy = [&] {
+    if (colored) {
+      if (stream == OutputStream::kStdout) {
+        SetOutputColor(end_token);
+      } else {
+        SetErrorColor(end_token);
+      }
+    }
+    os << std::endl;
+  };
+
+  if constexpr (ThreadSafe) {
+    try {
+      functy();
+    } catch (...) {
+      LoggerLock<ThreadSafe>::Unlock();
+      throw;
+    }
+    LoggerLock<ThreadSafe>::Unlock();
+  } else {
+    functy();
+  }
+}
+
+template <bool ThreadSafe>
+template <typename Functy>
+std::ostream& LoggerCore<ThreadSafe>::HandleThreadSafe(Functy&& functy) {
+  if constexpr (ThreadSafe) {
+    LoggerLock<ThreadSafe>::Lock();
+    try {
+      return functy();
+    } catch (...) {
+      LoggerLock<ThreadSafe>::Unlock();
+      throw;
+    }
+  } else {
+    return functy();
+  }
+}
@@ -39,6 +39,7 @@ extern "C" __declspec(dllimport) BOOL
     __stdcall GetConsoleScreenBufferInfo(HANDLE, PCONSOLE_SCREEN_BUFFER_INFO);
 extern "C" __declspec(dllimport) BOOL
     __stdcall SetConsoleTextAttribute(HANDLE, WORD);
+extern "C" __declspec(dllimport) DWORD __stdcall GetCurrentThreadId();
 
 #ifndef _APISETCONSOLEL2_
 
@@ -9,13 +9,26 @@
 #include <simple_logger/defs.hpp>
 
 #include <cstdint>
-#include <functional>
-#include <iostream>
-#include <mutex>
+#include <ostream>
 #include <string_view>
 #include <utility>
 
+#include <fmt/core.h>
+
+#if !defined(SIMPLE_LOGGER_COMPILED_LIB)
+#include <iostream>
+#include <mutex>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sys/syscall.h>
+#elif !defined(_WIN32)
+#include <pthread.h>
+#include <thread>
+#endif  // OS
+
 #include <fmt/chrono.h>
+#endif  // SIMPLE_LOGGER_COMPILED_LIB
 
 #define SIMPLE_LOGGER_LOG_NONE_LEVEL  0
 #define SIMPLE_LOGGER_LOG_FATAL_LEVEL 1
@@ -60,27 +73,48 @@ static constexpr std::string_view kWarnPrompt  = "warn"sv;
 static constexpr std::string_view kErrorPrompt = "error"sv;
 static constexpr std::string_view kFatalPrompt = "fatal"sv;
 
-template <bool ThreadSafe>
-class LoggerLock {
- private:
-  static void Lock() {}
-  static void Unlock() {}
+enum class OutputStream { kStdout, kStderr };
 
-  friend class Logger<ThreadSafe>;
-};
+static constexpr unsigned kThreadIdField   = 1u << 0;
+static constexpr unsigned kThreadNameField = 1u << 1;
+static constexpr unsigned kThreadFields    = 0u
+#if defined(SIMPLE_LOGGER_ENABLE_THREAD_ID)
+                                          | kThreadIdField
+#endif  // SIMPLE_LOGGER_ENABLE_THREAD_ID
+#if defined(SIMPLE_LOGGER_ENABLE_THREAD_NAME)
+                                          | kThreadNameField
+#endif  // SIMPLE_LOGGER_ENABLE_THREAD_NAME
+    ;
 
-template <>
-class LoggerLock<true> {
- private:
-  static inline std::mutex lock;
+SIMPLE_LOGGER_INLINE void SetThreadName(std::string_view name);
 
- private:
-  static void Lock() { lock.lock(); }
-  static void Unlock() { lock.unlock(); }
+// Level-independent part of each log record: locking, color control and the
+// time/level prefix. Instantiated only in the library in compiled mode.
+template <bool ThreadSafe>
+class LoggerCore {
+ public:
+  static std::ostream& BeginRecord(OutputStream stream, std::string_view level,
+                                   unsigned thread_fields);
+  static std::ostream& BeginRecord(OutputStream stream, ColorCtlType token,
+                                   std::string_view level,
+                                   unsigned thread_fields,
+                                   ColorCtlType& end_token);
+  static void EndRecord(std::ostream& os, OutputStream stream, bool colored,
+                        ColorCtlType end_token);
 
-  friend class Logger<true>;
+ private:
+  template <typename Functy>
+  static std::ostream& HandleThreadSafe(Functy&& functy);
 };
 
+// Logger itself is deliberately not declared extern: its members are the
+// inline fast path and depend on the log level macros of each translation
+// unit, which an instantiation compiled into the library would not honor.
+#if defined(SIMPLE_LOGGER_COMPILED_LIB)
+extern template class LoggerCore<true>;
+extern template class LoggerCore<false>;
+#endif  // SIMPLE_LOGGER_COMPILED_LIB
+
 }  // namespace details
 
 template <bool ThreadSafe>
@@ -88,8 +122,9 @@ class Logger {
  public:
   class LogHelper {
    private:
-    LogHelper(std::ostream& os, const std::function<void()>& postfix)
-        : os_(os), postfix_(postfix) {}
+    LogHelper(std::ostream& os, details::OutputStream stream, bool colored,
+              details::ColorCtlType end_token)
+        : os_(os), stream_(stream), colored_(colored), end_token_(end_token) {}
     LogHelper(const LogHelper&)            = delete;
     LogHelper(LogHelper&&)                 = delete;
     LogHelper& operator=(const LogHelper&) = delete;
@@ -97,22 +132,9 @@ class Logger {
 
    public:
     ~LogHelper() noexcept(false) {
-      auto functy = [this] {
-        this->postfix_();
-        this->os_ << std::endl;
-      };
-
-      if constexpr (ThreadSafe) {
-        try {
-          functy();
-        } catch (...) {
-          details::LoggerLock<ThreadSafe>::Unlock();
-          throw;
-        }
-        details::LoggerLock<ThreadSafe>::Unlock();
-      } else {
-        functy();
-      }
+      details::LoggerCore<ThreadSafe>::EndRecord(this->os_, this->stream_,
+                                                 this->colored_,
+                                                 this->end_token_);
     }
 
    public:
@@ -129,7 +151,9 @@ class Logger {
 
    private:
     std::ostream&         os_;
-    std::function<void()> postfix_;
+    details::OutputStream stream_;
+    bool                  colored_;
+    details::ColorCtlType end_token_;
 
     friend class Logger;
   };
@@ -256,71 +280,57 @@ class Logger {
   }
 
  private:
-  void PrintTime(std::ostream& os) {
-    os << fmt::format("{:%Y-%m-%d %H:%M:%S} ",
-                      fmt::localtime(std::chrono::system_clock::to_time_t(
-                          std::chrono::system_clock::now())));
-  }
-
   LogHelper StdoutLog(details::ColorCtlType token, std::string_view level) {
-    auto functy = [&] {
-      auto end_token = details::GetOutputEndColorToken();
-      details::SetOutputColor(token);
-      Logger::PrintTime(std::cout);
-      std::cout << '[' << level << "] ";
-      return LogHelper(std::cout, [=] { details::SetOutputColor(end_token); });
-    };
-    return this->HandleThreadSafe(functy);
+    return this->ColoredLog(details::OutputStream::kStdout, token, level);
   }
 
   LogHelper StdoutLog(std::string_view level) {
-    auto functy = [&] {
-      Logger::PrintTime(std::cout);
-      std::cout << '[' << level << "] ";
-      return LogHelper(std::cout, [] {});
-    };
-    return this->HandleThreadSafe(functy);
+    return this->PlainLog(details::OutputStream::kStdout, level);
   }
 
   LogHelper StderrLog(details::ColorCtlType token, std::string_view level) {
-    auto functy = [&] {
-      auto end_token = details::GetErrorEndColorToken();
-      details::SetErrorColor(token);
-      Logger::PrintTime(std::cerr);
-      std::cerr << '[' << level << "] ";
-      return LogHelper(std::cerr, [=] { details::SetErrorColor(end_token); });
-    };
-    return this->HandleThreadSafe(functy);
+    return this->ColoredLog(details::OutputStream::kStderr, token, level);
   }
 
   LogHelper StderrLog(std::string_view level) {
-    auto functy = [&] {
-      Logger::PrintTime(std::cerr);
-      std::cerr << '[' << level << "] ";
-      return LogHelper(std::cerr, [] {});
-    };
-    return this->HandleThreadSafe(functy);
+    return this->PlainLog(details::OutputStream::kStderr, level);
   }
 
-  template <typename Functy>
-  LogHelper HandleThreadSafe(Functy&& functy) {
-    if constexpr (ThreadSafe) {
-      details::LoggerLock<ThreadSafe>::Lock();
-      try {
-        return functy();
-      } catch (...) {
-        details::LoggerLock<ThreadSafe>::Unlock();
-        throw;
-      }
-    } else {
-      return functy();
-    }
+  LogHelper ColoredLog(details::OutputStream stream, details::ColorCtlType token,
+                       std::string_view level) {
+    details::ColorCtlType end_token {};
+    auto&                 os = details::LoggerCore<ThreadSafe>::BeginRecord(
+        stream, token, level, details::kThreadFields, end_token);
+    return LogHelper(os, stream, true, end_token);
+  }
+
+  LogHelper PlainLog(details::OutputStream stream, std::string_view level) {
+    auto& os = details::LoggerCore<ThreadSafe>::BeginRecord(
+        stream, level, details::kThreadFields);
+    return LogHelper(os, stream, false, details::ColorCtlType {});
   }
 };
 
+// Maximum length of a thread name; longer names are truncated.
+static constexpr std::size_t kMaxThreadNameLength = 32;
+
+// Sets the name of the calling thread shown in its log records when
+// SIMPLE_LOGGER_ENABLE_THREAD_NAME is defined.
+inline void SetThreadName(std::string_view name) {
+  details::SetThreadName(name);
+}
+
 inline Logger<true>  logger;    // Thread-safe
 inline Logger<false> uslogger;  // Thread-unsafe
 
+#if !defined(SIMPLE_LOGGER_COMPILED_LIB)
+namespace details {
+
+#include "details/logger_core.ipp"
+
+}  // namespace details
+#endif  // SIMPLE_LOGGER_COMPILED_LIB
+
 SIMPLE_LOGGER_NAMESPACE_END
 
 #endif  // SIMPLE_LOGGER_HPP_
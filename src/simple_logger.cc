@@ -0,0 +1,36 @@
+// This file is part of simple_logger.
+// Copyright (c) 2023, Timothy Liu. All rights reserved.
+// License    : MIT License
+// Project URL: https://github.com/Timothy-Liuxf/simple_logger
+
+#ifndef SIMPLE_LOGGER_COMPILED_LIB
+#error "SIMPLE_LOGGER_COMPILED_LIB must be defined to build this file."
+#endif  // SIMPLE_LOGGER_COMPILED_LIB
+
+#include <simple_logger/simple_logger.hpp>
+
+#include <iostream>
+#include <mutex>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sys/syscall.h>
+#elif !defined(_WIN32)
+#include <pthread.h>
+#include <thread>
+#endif  // OS
+
+#include <fmt/chrono.h>
+
+SIMPLE_LOGGER_NAMESPACE_BEGIN
+
+namespace details {
+
+#include <simple_logger/details/logger_core.ipp>
+
+template class LoggerCore<true>;
+template class LoggerCore<false>;
+
+}  // namespace details
+
+SIMPLE_LOGGER_NAMESPACE_END
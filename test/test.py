@@ -11,6 +11,7 @@ import platform
 import subprocess
 
 test_result_dir = 'test/test_results'
+unix_test_result_dir = f'{test_result_dir}/unix'
 
 def assertTrue(cond: bool, msg: str='Test failed!'):
     if not cond:
@@ -28,8 +29,11 @@ def getExecutionPath(test_name: str) -> str:
 
 def main():
     prev_dir = os.getcwd()
+    result_dirs = [test_result_dir]
+    if not isPlatformWindows():
+        result_dirs.append(unix_test_result_dir)
     result_files = [
-        f'{test_result_dir}/{file}' for file in os.listdir(test_result_dir)]
+        f'{dir}/{file}' for dir in result_dirs for file in os.listdir(dir)]
     result_files = [file for file in result_files if os.path.isfile(file)]
     for result_file in result_files:
         test_name = os.path.splitext(os.path.basename(result_file))[0]
@@ -43,6 +47,7 @@ def main():
         with open(result_file, 'r') as f:
             expected = json.load(f)
         assertTrue(len(result) == len(expected), f'{test_name} test failed: length not equal!')
+        thread_ids = {}
         for i in range(len(result)):
             if expected[i]['level'] == 'none':
                 expected_rgx = '^' + expected[i]['regex'] + '$'
@@ -75,7 +80,18 @@ def main():
                     if len(postfix) != 0:
                         result[i] = result[i][len(prefix):-len(postfix)]
 
-            assertTrue(re.match(expected_rgx, result[i]) != None, f'{test_name} test failed at line {i + 1}: expected: {expected_rgx}, result: {result[i]}!')
+            match = re.match(expected_rgx, result[i])
+            assertTrue(match != None, f'{test_name} test failed at line {i + 1}: expected: {expected_rgx}, result: {result[i]}!')
+            if 'thread' in expected[i]:
+                # The first group captures the thread ID: records of the same
+                # thread must share it, records of different threads must not.
+                thread_id = match.group(1)
+                thread = expected[i]['thread']
+                if thread in thread_ids:
+                    assertTrue(thread_ids[thread] == thread_id, f'{test_name} test failed at line {i + 1}: thread ID of {thread} changed!')
+                else:
+                    assertTrue(thread_id not in thread_ids.values(), f'{test_name} test failed at line {i + 1}: thread ID of {thread} not distinct!')
+                    thread_ids[thread] = thread_id
         print(f'Passed!')
 
 if __name__ == '__main__':